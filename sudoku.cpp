@@ -5,6 +5,15 @@
 #include <queue>
 #include <chrono>
 #include <cmath>
+#include <climits>
+#include <thread>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <getopt.h>
 #include <windows.h>
 #include <psapi.h>
@@ -16,8 +25,10 @@ const int N = 9; // Tamanho do tabuleiro do Sudoku
 enum Algoritmo {
     DFS,
     BFS,
+    BFSParalelo,
     Guloso,
-    AEstrela
+    AEstrela,
+    IDAEstrela
 }; // Algoritimos utilizados para resolver o Sudoku
 
 // Função para imprimir o tabuleiro de Sudoku
@@ -64,38 +75,57 @@ bool eSeguro(const vector<vector<int>>& tabuleiro, int linha, int coluna, int nu
 }
 
 // Função de busca em profundidade (DFS) para resolver o Sudoku
+// Versão iterativa: as células vazias são listadas uma única vez e percorridas com uma pilha explícita,
+// onde cada profundidade guarda o último número tentado (trilha usada para desfazer as atribuições)
 bool resolverSudokuDFS(vector<vector<int>>& tabuleiro) {
-    int linha = -1, coluna = -1;
-    bool vazio = false;
+    int vazias[N * N];  // Posições (linha * N + coluna) das células vazias, na ordem em que serão preenchidas
+    int totalVazias = 0;
     
-    // Encontra uma célula vazia
-    for (int i = 0; i < N && !vazio; i++) {
-        for (int j = 0; j < N && !vazio; j++) {
+    // Encontra todas as células vazias
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
             if (tabuleiro[i][j] == 0) {
-                linha = i;
-                coluna = j;
-                vazio = true;
+                vazias[totalVazias++] = i * N + j;
             }
         }
     }
     
     // Se não há células vazias, o Sudoku está resolvido
-    if (!vazio) {
-        return true; 
+    if (totalVazias == 0) {
+        return true;
     }
 
-    // Tenta números de 1 a 9 na célula vazia
-    for (int num = 1; num <= 9; num++) {
-        if (eSeguro(tabuleiro, linha, coluna, num)) { // Verifica se o número é seguro para ser colocado na célula vazia (ou seja, não está presente na linha, coluna e quadrado 3x3)
-            tabuleiro[linha][coluna] = num; // Atribui o número à célula vazia
-            if (resolverSudokuDFS(tabuleiro)) { // Chamada da função recursiva para resolver as outras células, se True, o Sudoku está resolvido
-                return true;
-            }
-            tabuleiro[linha][coluna] = 0; // Se a atribuição do número não levar a uma solução, a célula é redefinida para 0
+    int trilha[N * N];  // Último número atribuído em cada profundidade da pilha
+    int profundidade = 0;
+    trilha[0] = 0;
+
+    while (profundidade >= 0) {
+        int linha = vazias[profundidade] / N;
+        int coluna = vazias[profundidade] % N;
+        tabuleiro[linha][coluna] = 0; // Desfaz a atribuição anterior desta profundidade (se houver)
+
+        // Tenta os números seguintes ao último já tentado nesta célula
+        int num = trilha[profundidade] + 1;
+        while (num <= 9 && !eSeguro(tabuleiro, linha, coluna, num)) {
+            num++;
         }
+
+        if (num > 9) {
+            profundidade--; // Nenhum número serve: retrocede para a célula anterior
+            continue;
+        }
+
+        tabuleiro[linha][coluna] = num; // Atribui o número à célula vazia
+        trilha[profundidade] = num;
+
+        profundidade++;
+        if (profundidade == totalVazias) {
+            return true; // Todas as células vazias foram preenchidas
+        }
+        trilha[profundidade] = 0;
     }
 
-    return false; // Retorna False se não houver solução para a célula vazia. Indicando que não é possível resolver o Sudoku
+    return false; // Retorna False se não houver solução. Todas as atribuições já foram desfeitas
 }
 
 // Função de busca em largura (BFS) para resolver o Sudoku
@@ -140,6 +170,96 @@ bool resolverSudokuBFS(vector<vector<int>>& tabuleiro) {
     return false;
 }
 
+const size_t MIN_TABULEIROS_POR_THREAD = 32; // Abaixo disso o nível é expandido sem criar threads
+
+// Função que expande os tabuleiros [inicio, fim) de um nível da BFS para o buffer de saída da thread
+// Retorna o índice do primeiro tabuleiro já resolvido no intervalo (-1 se não houver)
+long long expandirNivelBFS(const vector<vector<vector<int>>>& nivel, size_t inicio, size_t fim, vector<vector<vector<int>>>& saida) {
+    for (size_t k = inicio; k < fim; k++) {
+        const vector<vector<int>>& curr = nivel[k];
+        int linha = -1, coluna = -1;
+        bool vazio = false;
+
+        // Encontra uma célula vazia
+        for (int i = 0; i < N && !vazio; i++) {
+            for (int j = 0; j < N && !vazio; j++) {
+                if (curr[i][j] == 0) {
+                    linha = i;
+                    coluna = j;
+                    vazio = true;
+                }
+            }
+        }
+
+        // Se não há células vazias, o Sudoku está resolvido
+        if (!vazio) {
+            return k;
+        }
+
+        // Tenta números de 1 a 9 na célula vazia
+        for (int num = 1; num <= 9; num++) {
+            if (eSeguro(curr, linha, coluna, num)) {
+                saida.push_back(curr);                  // Cria uma cópia do tabuleiro atual no buffer da thread
+                saida.back()[linha][coluna] = num;      // Atribui o número à célula vazia nesse novo tabuleiro
+            }
+        }
+    }
+
+    return -1;
+}
+
+// Função de busca em largura (BFS) paralela para resolver o Sudoku
+// Processa um nível por vez: os tabuleiros do nível são divididos entre as threads, cada uma escreve os
+// filhos no seu próprio buffer e os buffers são concatenados em ordem para formar o próximo nível
+bool resolverSudokuBFSParalelo(vector<vector<int>>& tabuleiro) {
+    size_t maxThreads = max(1u, thread::hardware_concurrency());
+    vector<vector<vector<int>>> nivel(1, tabuleiro);
+
+    while (!nivel.empty()) {
+        size_t numThreads = min(maxThreads, max<size_t>(1, nivel.size() / MIN_TABULEIROS_POR_THREAD));
+        vector<vector<vector<vector<int>>>> saidas(numThreads);    // Buffer de saída de cada thread
+        vector<long long> resolvidos(numThreads, -1);               // Primeiro tabuleiro resolvido de cada thread
+
+        if (numThreads == 1) {
+            resolvidos[0] = expandirNivelBFS(nivel, 0, nivel.size(), saidas[0]);
+        } else {
+            vector<thread> threads;
+            for (size_t t = 0; t < numThreads; t++) {
+                size_t inicio = nivel.size() * t / numThreads;
+                size_t fim = nivel.size() * (t + 1) / numThreads;
+                threads.emplace_back([&, t, inicio, fim]() {
+                    resolvidos[t] = expandirNivelBFS(nivel, inicio, fim, saidas[t]);
+                });
+            }
+            for (thread& th : threads) {
+                th.join();
+            }
+        }
+
+        // Todos os tabuleiros de um nível têm o mesmo número de células vazias: devolve o primeiro resolvido
+        for (size_t t = 0; t < numThreads; t++) {
+            if (resolvidos[t] != -1) {
+                tabuleiro = nivel[resolvidos[t]];
+                return true;
+            }
+        }
+
+        // Junta os buffers das threads, na ordem, no próximo nível
+        size_t tamanho = 0;
+        for (const auto& saida : saidas) {
+            tamanho += saida.size();
+        }
+        vector<vector<vector<int>>> proximoNivel;
+        proximoNivel.reserve(tamanho);
+        for (auto& saida : saidas) {
+            move(saida.begin(), saida.end(), back_inserter(proximoNivel));
+        }
+        nivel.swap(proximoNivel);
+    }
+
+    return false;
+}
+
 // Função para ler o Sudoku de um arquivo .txt
 vector<vector<int>> lerSudoku(const string& nomeArquivo) {
     ifstream arquivo(nomeArquivo);
@@ -200,13 +320,432 @@ bool verificarSolucao(const vector<vector<int>>& tabuleiro) {
     return true;
 }
 
+const size_t CAPACIDADE_CACHE = 1000; // Número máximo de tabuleiros guardados em cada cache
+const int LIMITE_NOS_CANONICA = 20000;  // Máximo de linhas avaliadas na busca pela forma canônica
+
+// Permutações de 3 elementos, usadas para trocar linhas/colunas dentro de uma faixa e trocar as faixas
+const int PERMUTACOES[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+// Transformação (simetria do Sudoku) que leva um tabuleiro à sua forma canônica
+struct TransformacaoSudoku {
+    bool transposta;    // Se o tabuleiro é transposto antes de permutar linhas e colunas
+    int linhas[N];      // Linha de origem de cada linha da forma canônica
+    int colunas[N];     // Coluna de origem de cada coluna da forma canônica
+    int rotulo[N + 1];  // Número canônico de cada número original (0 continua sendo vazio)
+};
+
+// Estado da busca pela forma canônica (menor tabuleiro equivalente em ordem lexicográfica)
+struct BuscaCanonica {
+    int grade[N][N];        // Tabuleiro já transposto (se for o caso); as colunas são lidas pela transformação
+    int atual[N][N];        // Linhas já escolhidas e renomeadas no ramo atual
+    int melhor[N][N];       // Menor forma encontrada até o momento
+    bool temMelhor;
+    bool linhaUsada[N];
+    int classeLinha[N];     // Primeira linha da mesma faixa com o mesmo conteúdo (linhas iguais geram os mesmos ramos)
+    int primeiraLinha;      // Linha fixada como primeira linha da forma canônica
+    int nosRestantes;       // Linhas que ainda podem ser avaliadas antes de encerrar a busca
+    TransformacaoSudoku transformacao;          // Transformação do ramo atual
+    TransformacaoSudoku melhorTransformacao;    // Transformação que gera a melhor forma
+};
+
+// Função recursiva que escolhe as linhas da forma canônica (retorna True se a melhor forma foi atualizada)
+bool buscarLinhasCanonicas(BuscaCanonica& busca, int profundidade, bool menor, const int rotulo[], int proximoRotulo) {
+    if (profundidade == N) {
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                busca.melhor[i][j] = busca.atual[i][j];
+            }
+        }
+        for (int num = 0; num <= N; num++) {
+            busca.transformacao.rotulo[num] = rotulo[num];
+        }
+        busca.melhorTransformacao = busca.transformacao;
+        busca.temMelhor = true;
+        return true;
+    }
+
+    bool atualizou = false;
+    for (int linha = 0; linha < N && busca.nosRestantes > 0; linha++) {
+        // As linhas de uma faixa precisam ficar juntas: fora do início de uma faixa, só linhas da faixa atual
+        if (busca.linhaUsada[linha] || (profundidade % 3 != 0 && linha / 3 != busca.transformacao.linhas[profundidade - 1] / 3)) {
+            continue;
+        }
+        if (profundidade == 0 && linha != busca.primeiraLinha) {
+            continue;
+        }
+        bool repetida = false; // Uma linha igual e ainda livre na mesma faixa já foi tentada nesta profundidade
+        for (int outra = linha - linha % 3; outra < linha && !repetida; outra++) {
+            repetida = !busca.linhaUsada[outra] && busca.classeLinha[outra] == busca.classeLinha[linha];
+        }
+        if (repetida) {
+            continue;
+        }
+        busca.nosRestantes--;
+
+        // Renomeia os números na ordem em que aparecem e compara com a melhor forma
+        int novoRotulo[N + 1];
+        for (int num = 0; num <= N; num++) {
+            novoRotulo[num] = rotulo[num];
+        }
+        int novoProximoRotulo = proximoRotulo;
+        int comparacao = menor ? -1 : 0;
+        for (int j = 0; j < N && comparacao <= 0; j++) {
+            int num = busca.grade[linha][busca.transformacao.colunas[j]];
+            if (num != 0 && novoRotulo[num] == 0) {
+                novoRotulo[num] = novoProximoRotulo++;
+            }
+            busca.atual[profundidade][j] = novoRotulo[num];
+            if (comparacao == 0 && busca.atual[profundidade][j] != busca.melhor[profundidade][j]) {
+                comparacao = busca.atual[profundidade][j] < busca.melhor[profundidade][j] ? -1 : 1;
+            }
+        }
+        if (comparacao > 0) {
+            continue; // Ramo já é maior que a melhor forma encontrada
+        }
+
+        busca.linhaUsada[linha] = true;
+        busca.transformacao.linhas[profundidade] = linha;
+        if (buscarLinhasCanonicas(busca, profundidade + 1, comparacao < 0, novoRotulo, novoProximoRotulo)) {
+            atualizou = true;
+            menor = false; // A melhor forma agora tem o mesmo prefixo deste ramo
+        }
+        busca.linhaUsada[linha] = false;
+    }
+
+    return atualizou;
+}
+
+// Função que encontra a forma canônica de um tabuleiro e a transformação que leva até ela
+// Os números de uma linha são distintos, então a primeira linha renomeada depende apenas de quantos vazios
+// cada pilha tem nela: só as linhas e arranjos de colunas que produzem a menor primeira linha são buscados.
+// Tabuleiros muito simétricos (quase vazios) param após LIMITE_NOS_CANONICA linhas avaliadas; a forma
+// devolvida continua sendo equivalente ao tabuleiro, apenas pode não ser a menor (perde acertos no cache)
+TransformacaoSudoku canonizarSudoku(const vector<vector<int>>& tabuleiro, string& canonico) {
+    BuscaCanonica busca;
+    busca.temMelhor = false;
+    busca.nosRestantes = LIMITE_NOS_CANONICA;
+    for (int i = 0; i < N; i++) {
+        busca.linhaUsada[i] = false;
+    }
+    const int rotuloInicial[N + 1] = {0};
+
+    // Conta os vazios de cada pilha em cada linha (por transposição) e encontra o melhor padrão da primeira linha:
+    // mais vazios no início dá uma linha menor, então o padrão é a contagem por pilha em ordem decrescente
+    int vaziosPilha[2][N][3];
+    int melhorPadrao[3] = {-1, -1, -1};
+    for (int transposta = 0; transposta < 2; transposta++) {
+        for (int linha = 0; linha < N; linha++) {
+            for (int pilha = 0; pilha < 3; pilha++) {
+                vaziosPilha[transposta][linha][pilha] = 0;
+                for (int k = 0; k < 3; k++) {
+                    int coluna = 3 * pilha + k;
+                    int num = transposta ? tabuleiro[coluna][linha] : tabuleiro[linha][coluna];
+                    vaziosPilha[transposta][linha][pilha] += num == 0;
+                }
+            }
+            int padrao[3] = {vaziosPilha[transposta][linha][0], vaziosPilha[transposta][linha][1], vaziosPilha[transposta][linha][2]};
+            sort(padrao, padrao + 3, greater<int>());
+            if (lexicographical_compare(melhorPadrao, melhorPadrao + 3, padrao, padrao + 3)) {
+                copy(padrao, padrao + 3, melhorPadrao);
+            }
+        }
+    }
+
+    for (int transposta = 0; transposta < 2 && busca.nosRestantes > 0; transposta++) {
+        busca.transformacao.transposta = transposta;
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                busca.grade[i][j] = transposta ? tabuleiro[j][i] : tabuleiro[i][j];
+            }
+        }
+
+        // Linhas iguais na mesma faixa e colunas iguais são intercambiáveis: marca cada uma com a primeira igual
+        int classeColuna[N];
+        bool colunasIguais = false;
+        for (int i = 0; i < N; i++) {
+            busca.classeLinha[i] = i;
+            for (int outra = i - i % 3; outra < i && busca.classeLinha[i] == i; outra++) {
+                if (equal(busca.grade[i], busca.grade[i] + N, busca.grade[outra])) {
+                    busca.classeLinha[i] = outra;
+                }
+            }
+            classeColuna[i] = i;
+            for (int outra = 0; outra < i && classeColuna[i] == i; outra++) {
+                bool iguais = true;
+                for (int k = 0; k < N && iguais; k++) {
+                    iguais = busca.grade[k][i] == busca.grade[k][outra];
+                }
+                if (iguais) {
+                    classeColuna[i] = outra;
+                    colunasIguais = true;
+                }
+            }
+        }
+
+        for (int primeira = 0; primeira < N && busca.nosRestantes > 0; primeira++) {
+            const int* vazios = vaziosPilha[transposta][primeira];
+            int padrao[3] = {vazios[0], vazios[1], vazios[2]};
+            sort(padrao, padrao + 3, greater<int>());
+            if (!equal(padrao, padrao + 3, melhorPadrao) || busca.classeLinha[primeira] != primeira) {
+                continue; // Esta linha não pode ser a primeira da forma canônica (ou uma linha igual já foi tentada)
+            }
+            busca.primeiraLinha = primeira;
+            unordered_set<long long> arranjosVistos; // Arranjos que leem as mesmas colunas geram a mesma busca
+
+            // Em cada pilha, só as ordens de colunas que colocam os vazios da primeira linha antes dos números
+            int internasValidas[3][6];
+            int totalInternas[3] = {0, 0, 0};
+            for (int pilha = 0; pilha < 3; pilha++) {
+                for (int p = 0; p < 6; p++) {
+                    bool valida = true;
+                    for (int k = 0; k + 1 < 3 && valida; k++) {
+                        int num = busca.grade[primeira][3 * pilha + PERMUTACOES[p][k]];
+                        int numProximo = busca.grade[primeira][3 * pilha + PERMUTACOES[p][k + 1]];
+                        valida = !(num != 0 && numProximo == 0);
+                    }
+                    // Ordens que leem colunas iguais na mesma sequência de uma ordem já aceita são repetidas
+                    for (int q = 0; q < totalInternas[pilha] && valida; q++) {
+                        bool mesmaSequencia = true;
+                        for (int k = 0; k < 3 && mesmaSequencia; k++) {
+                            mesmaSequencia = classeColuna[3 * pilha + PERMUTACOES[p][k]] == classeColuna[3 * pilha + PERMUTACOES[internasValidas[pilha][q]][k]];
+                        }
+                        valida = !mesmaSequencia;
+                    }
+                    if (valida) {
+                        internasValidas[pilha][totalInternas[pilha]++] = p;
+                    }
+                }
+            }
+
+            // Percorre as ordens de pilhas com vazios em ordem decrescente e as ordens internas válidas
+            for (int pilhas = 0; pilhas < 6 && busca.nosRestantes > 0; pilhas++) {
+                const int* ordem = PERMUTACOES[pilhas];
+                if (vazios[ordem[0]] < vazios[ordem[1]] || vazios[ordem[1]] < vazios[ordem[2]]) {
+                    continue;
+                }
+                for (int i0 = 0; i0 < totalInternas[ordem[0]] && busca.nosRestantes > 0; i0++) {
+                    for (int i1 = 0; i1 < totalInternas[ordem[1]] && busca.nosRestantes > 0; i1++) {
+                        for (int i2 = 0; i2 < totalInternas[ordem[2]] && busca.nosRestantes > 0; i2++) {
+                            const int internas[3] = {internasValidas[ordem[0]][i0], internasValidas[ordem[1]][i1], internasValidas[ordem[2]][i2]};
+                            long long chave = 0;
+                            for (int j = 0; j < N; j++) {
+                                busca.transformacao.colunas[j] = 3 * ordem[j / 3] + PERMUTACOES[internas[j / 3]][j % 3];
+                                chave = chave * N + classeColuna[busca.transformacao.colunas[j]];
+                            }
+                            if (colunasIguais && !arranjosVistos.insert(chave).second) {
+                                continue;
+                            }
+                            buscarLinhasCanonicas(busca, 0, !busca.temMelhor, rotuloInicial, 1);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Completa a troca de números com os números que não aparecem no tabuleiro
+    TransformacaoSudoku transformacao = busca.melhorTransformacao;
+    int proximoRotulo = 1;
+    for (int num = 1; num <= N; num++) {
+        if (transformacao.rotulo[num] != 0) {
+            proximoRotulo++;
+        }
+    }
+    for (int num = 1; num <= N; num++) {
+        if (transformacao.rotulo[num] == 0) {
+            transformacao.rotulo[num] = proximoRotulo++;
+        }
+    }
+
+    canonico.assign(N * N, '0');
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            canonico[i * N + j] = '0' + busca.melhor[i][j];
+        }
+    }
+    return transformacao;
+}
+
+// Função que aplica a transformação a um tabuleiro, devolvendo a sua forma canônica em texto
+string aplicarTransformacao(const vector<vector<int>>& tabuleiro, const TransformacaoSudoku& transformacao) {
+    string canonico(N * N, '0');
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            int linha = transformacao.linhas[i], coluna = transformacao.colunas[j];
+            int num = transformacao.transposta ? tabuleiro[coluna][linha] : tabuleiro[linha][coluna];
+            canonico[i * N + j] = '0' + transformacao.rotulo[num];
+        }
+    }
+    return canonico;
+}
+
+// Função que desfaz a transformação, escrevendo no tabuleiro o equivalente de uma forma canônica
+void desfazerTransformacao(const string& canonico, const TransformacaoSudoku& transformacao, vector<vector<int>>& tabuleiro) {
+    int original[N + 1] = {0}; // Inversa da troca de números
+    for (int num = 1; num <= N; num++) {
+        original[transformacao.rotulo[num]] = num;
+    }
+
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            int linha = transformacao.linhas[i], coluna = transformacao.colunas[j];
+            int num = original[canonico[i * N + j] - '0'];
+            if (transformacao.transposta) {
+                tabuleiro[coluna][linha] = num;
+            } else {
+                tabuleiro[linha][coluna] = num;
+            }
+        }
+    }
+}
+
+// Cache LRU de tabuleiro (em texto) para solução (em texto)
+struct CacheLRU {
+    size_t capacidade = CAPACIDADE_CACHE;
+    list<pair<string, string>> itens; // Do mais recente para o menos recente
+    unordered_map<string, list<pair<string, string>>::iterator> indice;
+};
+
+// Cache de soluções de um algoritmo: formas canônicas (salvas em disco) e tabuleiros exatamente repetidos,
+// que são respondidos sem calcular a forma canônica
+struct CacheSudoku {
+    CacheLRU canonicos;
+    CacheLRU repetidos;
+};
+
+// Função para buscar a solução de um tabuleiro no cache (o item passa a ser o mais recente)
+bool buscarNoCache(CacheLRU& cache, const string& tabuleiro, string& solucao) {
+    auto item = cache.indice.find(tabuleiro);
+    if (item == cache.indice.end()) {
+        return false;
+    }
+    cache.itens.splice(cache.itens.begin(), cache.itens, item->second);
+    solucao = item->second->second;
+    return true;
+}
+
+// Função para inserir uma solução no cache, descartando o item menos recente se o cache estiver cheio
+void inserirNoCache(CacheLRU& cache, const string& tabuleiro, const string& solucao) {
+    auto item = cache.indice.find(tabuleiro);
+    if (item != cache.indice.end()) {
+        item->second->second = solucao;
+        cache.itens.splice(cache.itens.begin(), cache.itens, item->second);
+        return;
+    }
+    if (cache.itens.size() >= cache.capacidade) {
+        cache.indice.erase(cache.itens.back().first);
+        cache.itens.pop_back();
+    }
+    cache.itens.emplace_front(tabuleiro, solucao);
+    cache.indice[tabuleiro] = cache.itens.begin();
+}
+
+// Função que verifica se um texto lido do arquivo de cache representa um tabuleiro (só dígitos de 0 a 9)
+bool tabuleiroEmTextoValido(const string& texto, bool permiteVazio) {
+    if (texto.size() != N * N) {
+        return false;
+    }
+    for (char c : texto) {
+        if (c < (permiteVazio ? '0' : '1') || c > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Função que verifica se um item lido do arquivo de cache é utilizável: a solução precisa ser um Sudoku
+// resolvido corretamente e manter os números já preenchidos no tabuleiro canônico
+bool itemDeCacheValido(const string& canonico, const string& solucao) {
+    if (!tabuleiroEmTextoValido(canonico, true) || !tabuleiroEmTextoValido(solucao, false)) {
+        return false;
+    }
+
+    vector<vector<int>> tabuleiro(N, vector<int>(N, 0));
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            if (canonico[i * N + j] != '0' && canonico[i * N + j] != solucao[i * N + j]) {
+                return false; // A solução contradiz um número do tabuleiro
+            }
+            tabuleiro[i][j] = solucao[i * N + j] - '0';
+        }
+    }
+    return verificarSolucao(tabuleiro);
+}
+
+// Função para carregar as formas canônicas de um arquivo .txt (uma linha por item: tabuleiro e solução canônicos)
+// Linhas com uma solução inválida ou que não corresponda ao tabuleiro são ignoradas
+void carregarCache(CacheSudoku& cache, const string& nomeArquivo) {
+    CacheLRU& canonicos = cache.canonicos;
+    ifstream arquivo(nomeArquivo);
+    string canonico, solucao;
+    while (arquivo >> canonico >> solucao && canonicos.itens.size() < canonicos.capacidade) {
+        if (itemDeCacheValido(canonico, solucao) && canonicos.indice.find(canonico) == canonicos.indice.end()) {
+            canonicos.itens.emplace_back(canonico, solucao); // O arquivo está em ordem do mais recente para o menos recente
+            canonicos.indice[canonico] = prev(canonicos.itens.end());
+        }
+    }
+}
+
+// Função para salvar as formas canônicas do cache em um arquivo .txt
+bool salvarCache(const CacheSudoku& cache, const string& nomeArquivo) {
+    ofstream arquivo(nomeArquivo);
+    if (!arquivo.is_open()) {
+        return false;
+    }
+    for (const auto& item : cache.canonicos.itens) {
+        arquivo << item.first << " " << item.second << "\n";
+    }
+    return true;
+}
+
+// Função que converte um tabuleiro para texto (linha a linha, 0 = vazio)
+string textoDoTabuleiro(const vector<vector<int>>& tabuleiro) {
+    string texto(N * N, '0');
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            texto[i * N + j] = '0' + tabuleiro[i][j];
+        }
+    }
+    return texto;
+}
+
+// Função que resolve o Sudoku consultando o cache de tabuleiros equivalentes antes de executar o algoritmo
+bool resolverComCache(vector<vector<int>>& tabuleiro, bool (*resolverSudoku)(vector<vector<int>>&), CacheSudoku& cache) {
+    string texto = textoDoTabuleiro(tabuleiro), solucao;
+
+    if (buscarNoCache(cache.repetidos, texto, solucao)) { // Tabuleiro idêntico a um já resolvido
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                tabuleiro[i][j] = solucao[i * N + j] - '0';
+            }
+        }
+        return true;
+    }
+
+    string canonico;
+    TransformacaoSudoku transformacao = canonizarSudoku(tabuleiro, canonico);
+
+    if (buscarNoCache(cache.canonicos, canonico, solucao)) {
+        desfazerTransformacao(solucao, transformacao, tabuleiro); // Leva a solução canônica de volta ao tabuleiro original
+    } else {
+        if (!resolverSudoku(tabuleiro)) {
+            return false;
+        }
+        inserirNoCache(cache.canonicos, canonico, aplicarTransformacao(tabuleiro, transformacao));
+    }
+    inserirNoCache(cache.repetidos, texto, textoDoTabuleiro(tabuleiro));
+    return true;
+}
+
 // Funcao que chama o algoritmo de resolucao do sudoku e retorna o tempo de execucao (-1 para error)
-int resolve(vector<vector<int>> &tabuleiro, bool (*resolverSudoku)(vector<vector<int>>&), bool imprimir, Algoritmo algoritmo) {
+// Se um cache for informado, tabuleiros equivalentes já resolvidos são respondidos sem busca
+int resolve(vector<vector<int>> &tabuleiro, bool (*resolverSudoku)(vector<vector<int>>&), bool imprimir, Algoritmo algoritmo, CacheSudoku* cache = nullptr) {
     int duracao = -1;
     chrono::steady_clock::time_point begin = chrono::steady_clock::now();
 
     string resultadoDoAlgoritimo = "XXXXXXX"; // Se o algoritmo não resolver o Sudoku, o resultado será XXXXXXX
-    if (resolverSudoku(tabuleiro)) {
+    bool resolvido = cache != nullptr ? resolverComCache(tabuleiro, resolverSudoku, *cache) : resolverSudoku(tabuleiro);
+    if (resolvido) {
         chrono::steady_clock::time_point end = chrono::steady_clock::now();
         duracao = chrono::duration_cast<chrono::microseconds>(end - begin).count();
 
@@ -226,12 +765,18 @@ int resolve(vector<vector<int>> &tabuleiro, bool (*resolverSudoku)(vector<vector
         case BFS:
             cout << "BFS: " << '\t';
             break;
+        case BFSParalelo:
+            cout << "BFS-P: " << '\t';
+            break;
         case Guloso:
             cout << "Guloso: ";
             break;
         case AEstrela:
             cout << "A*: " << '\t';
             break;
+        case IDAEstrela:
+            cout << "IDA*: " << '\t';
+            break;
         }
 
         if (duracao != -1) {
@@ -353,7 +898,8 @@ int contarCandidatosValidos(const vector<vector<int>>& tabuleiro, int linha, int
 }
 
 // Função para encontrar a célula com menos candidatos válidos ({-1, -1} para célula não encontrada)
-pair<int, int> encontrarCelulaComMenosCandidatos(const vector<vector<int>>& tabuleiro) {
+// Se menosCandidatos for informado, recebe o número de candidatos da célula encontrada
+pair<int, int> encontrarCelulaComMenosCandidatos(const vector<vector<int>>& tabuleiro, int* menosCandidatos = nullptr) {
     int minCandidatos = 10; // Maior que o número máximo de candidatos possíveis (9)
     pair<int, int> melhorCelula = {-1, -1};
 
@@ -369,33 +915,185 @@ pair<int, int> encontrarCelulaComMenosCandidatos(const vector<vector<int>>& tabu
         }
     }
 
+    if (menosCandidatos != nullptr) {
+        *menosCandidatos = minCandidatos;
+    }
     return melhorCelula;
 }
 
-// Função de busca gulosa para resolver o Sudoku
-bool resolverSudokuGuloso(vector<vector<int>>& tabuleiro) {
-    pair<int, int> melhorCelula = encontrarCelulaComMenosCandidatos(tabuleiro);
+const int NUM_VIZINHOS = 20; // Células que compartilham linha, coluna ou quadrado 3x3 com uma célula
+
+// Estado da busca gulosa: contagens de candidatos mantidas incrementalmente a cada atribuição
+struct EstadoGuloso {
+    int linhaUsada[N];                  // Máscara de bits dos números presentes em cada linha
+    int colunaUsada[N];                 // Máscara de bits dos números presentes em cada coluna
+    int quadradoUsado[N];               // Máscara de bits dos números presentes em cada quadrado 3x3
+    int vizinhos[N * N][NUM_VIZINHOS];  // Vizinhos de cada célula (linha * N + coluna)
+    int candidatos[N * N];              // Número de candidatos válidos de cada célula vazia
+    int balde[N + 1][N * N];            // Células vazias agrupadas pelo número de candidatos
+    int tamanhoBalde[N + 1];            // Quantidade de células em cada balde
+    int posicaoNoBalde[N * N];          // Posição de cada célula vazia dentro do seu balde
+};
+
+// Função que retorna o índice do quadrado 3x3 de uma célula
+int indiceQuadrado(int linha, int coluna) {
+    return (linha / 3) * 3 + coluna / 3;
+}
+
+// Função que retorna a máscara de bits dos candidatos válidos de uma célula (bit k = número k)
+int mascaraCandidatos(const EstadoGuloso& estado, int linha, int coluna) {
+    int usados = estado.linhaUsada[linha] | estado.colunaUsada[coluna] | estado.quadradoUsado[indiceQuadrado(linha, coluna)];
+    return ~usados & 0x3FE; // Bits de 1 a 9
+}
+
+// Função para inserir uma célula vazia no balde correspondente ao seu número de candidatos
+void inserirNoBalde(EstadoGuloso& estado, int celula, int candidatos) {
+    estado.candidatos[celula] = candidatos;
+    estado.posicaoNoBalde[celula] = estado.tamanhoBalde[candidatos];
+    estado.balde[candidatos][estado.tamanhoBalde[candidatos]++] = celula;
+}
+
+// Função para remover uma célula do seu balde (troca com a última célula do balde)
+void removerDoBalde(EstadoGuloso& estado, int celula) {
+    int candidatos = estado.candidatos[celula];
+    int posicao = estado.posicaoNoBalde[celula];
+    int ultima = estado.balde[candidatos][--estado.tamanhoBalde[candidatos]];
+    estado.balde[candidatos][posicao] = ultima;
+    estado.posicaoNoBalde[ultima] = posicao;
+}
+
+// Função para inicializar o estado da busca gulosa a partir do tabuleiro
+void inicializarEstadoGuloso(EstadoGuloso& estado, const vector<vector<int>>& tabuleiro) {
+    for (int i = 0; i < N; i++) {
+        estado.linhaUsada[i] = 0;
+        estado.colunaUsada[i] = 0;
+        estado.quadradoUsado[i] = 0;
+    }
+    for (int c = 0; c <= N; c++) {
+        estado.tamanhoBalde[c] = 0;
+    }
+
+    // Calcula os vizinhos de cada célula e marca os números já presentes
+    for (int celula = 0; celula < N * N; celula++) {
+        int linha = celula / N, coluna = celula % N;
+        int total = 0;
+        for (int x = 0; x < N; x++) {
+            if (x != coluna) {
+                estado.vizinhos[celula][total++] = linha * N + x; // Mesma linha
+            }
+            if (x != linha) {
+                estado.vizinhos[celula][total++] = x * N + coluna; // Mesma coluna
+            }
+        }
+        int startRow = linha - linha % 3, startCol = coluna - coluna % 3;
+        for (int i = startRow; i < startRow + 3; i++) {
+            for (int j = startCol; j < startCol + 3; j++) {
+                if (i != linha && j != coluna) {
+                    estado.vizinhos[celula][total++] = i * N + j; // Mesmo quadrado, fora da linha e da coluna
+                }
+            }
+        }
+
+        int num = tabuleiro[linha][coluna];
+        if (num != 0) {
+            estado.linhaUsada[linha] |= 1 << num;
+            estado.colunaUsada[coluna] |= 1 << num;
+            estado.quadradoUsado[indiceQuadrado(linha, coluna)] |= 1 << num;
+        }
+    }
+
+    // Distribui as células vazias nos baldes
+    for (int celula = 0; celula < N * N; celula++) {
+        int linha = celula / N, coluna = celula % N;
+        if (tabuleiro[linha][coluna] == 0) {
+            inserirNoBalde(estado, celula, __builtin_popcount(mascaraCandidatos(estado, linha, coluna)));
+        }
+    }
+}
+
+// Função para atribuir um número a uma célula, atualizando apenas os candidatos dos seus vizinhos
+void atribuirGuloso(EstadoGuloso& estado, vector<vector<int>>& tabuleiro, int celula, int num) {
+    int linha = celula / N, coluna = celula % N;
+    removerDoBalde(estado, celula);
+
+    // Vizinhos vazios que ainda tinham o número como candidato perdem um candidato
+    for (int vizinho : estado.vizinhos[celula]) {
+        int vizinhoLinha = vizinho / N, vizinhoColuna = vizinho % N;
+        if (tabuleiro[vizinhoLinha][vizinhoColuna] == 0 && (mascaraCandidatos(estado, vizinhoLinha, vizinhoColuna) & (1 << num))) {
+            int candidatos = estado.candidatos[vizinho];
+            removerDoBalde(estado, vizinho);
+            inserirNoBalde(estado, vizinho, candidatos - 1);
+        }
+    }
+
+    tabuleiro[linha][coluna] = num;
+    estado.linhaUsada[linha] |= 1 << num;
+    estado.colunaUsada[coluna] |= 1 << num;
+    estado.quadradoUsado[indiceQuadrado(linha, coluna)] |= 1 << num;
+}
+
+// Função para desfazer uma atribuição, devolvendo o candidato aos vizinhos que o recuperam
+void desfazerGuloso(EstadoGuloso& estado, vector<vector<int>>& tabuleiro, int celula, int num) {
+    int linha = celula / N, coluna = celula % N;
+    tabuleiro[linha][coluna] = 0;
+    estado.linhaUsada[linha] &= ~(1 << num);
+    estado.colunaUsada[coluna] &= ~(1 << num);
+    estado.quadradoUsado[indiceQuadrado(linha, coluna)] &= ~(1 << num);
+
+    for (int vizinho : estado.vizinhos[celula]) {
+        int vizinhoLinha = vizinho / N, vizinhoColuna = vizinho % N;
+        if (tabuleiro[vizinhoLinha][vizinhoColuna] == 0 && (mascaraCandidatos(estado, vizinhoLinha, vizinhoColuna) & (1 << num))) {
+            int candidatos = estado.candidatos[vizinho];
+            removerDoBalde(estado, vizinho);
+            inserirNoBalde(estado, vizinho, candidatos + 1);
+        }
+    }
+
+    inserirNoBalde(estado, celula, __builtin_popcount(mascaraCandidatos(estado, linha, coluna)));
+}
+
+// Função que retorna a célula vazia com menos candidatos a partir dos baldes (-1 se não houver célula vazia)
+int celulaComMenosCandidatos(const EstadoGuloso& estado) {
+    for (int c = 0; c <= N; c++) {
+        if (estado.tamanhoBalde[c] > 0) {
+            return estado.balde[c][0];
+        }
+    }
+    return -1;
+}
 
-    if (melhorCelula.first == -1 && melhorCelula.second == -1) {
+// Função recursiva da busca gulosa sobre o estado incremental
+bool buscaGulosa(vector<vector<int>>& tabuleiro, EstadoGuloso& estado) {
+    int celula = celulaComMenosCandidatos(estado);
+
+    if (celula == -1) {
         return true; // Sudoku resolvido
     }
 
-    int linha = melhorCelula.first;
-    int coluna = melhorCelula.second;
+    int linha = celula / N;
+    int coluna = celula % N;
+    int mascara = mascaraCandidatos(estado, linha, coluna); // Candidatos válidos (vazio se a célula não tiver candidatos)
 
     for (int num = 1; num <= 9; num++) {
-        if (eSeguro(tabuleiro, linha, coluna, num)) {   // Verifica se o número é seguro para ser colocado na célula vazia (ou seja, não está presente na linha, coluna e quadrado 3x3)
-            tabuleiro[linha][coluna] = num;             // Atribui o número à célula vazia
-            if (resolverSudokuGuloso(tabuleiro)) {      // Chamada da função recursiva para resolver as outras células, se True, o Sudoku está resolvido
+        if (mascara & (1 << num)) {                     // Verifica se o número é seguro para ser colocado na célula vazia
+            atribuirGuloso(estado, tabuleiro, celula, num);
+            if (buscaGulosa(tabuleiro, estado)) {       // Chamada da função recursiva para resolver as outras células, se True, o Sudoku está resolvido
                 return true;    // Sudoku resolvido
             }
-            tabuleiro[linha][coluna] = 0;               // Se a atribuição do número não levar a uma solução, a célula é redefinida para 0
+            desfazerGuloso(estado, tabuleiro, celula, num); // Se a atribuição do número não levar a uma solução, a célula é redefinida para 0
         }
     }
 
     return false;
 }
 
+// Função de busca gulosa para resolver o Sudoku
+bool resolverSudokuGuloso(vector<vector<int>>& tabuleiro) {
+    EstadoGuloso estado;
+    inicializarEstadoGuloso(estado, tabuleiro);
+    return buscaGulosa(tabuleiro, estado);
+}
+
 // Função de custo f(n) = g(n) + h(n)
 int funcaoCusto(const vector<vector<int>>& tabuleiro, int g) {
     int h = 0;
@@ -443,27 +1141,102 @@ bool resolverSudokuAEstrela(vector<vector<int>>& tabuleiro) {
     return false;
 }
 
+const int CUSTO_INFINITO = INT_MAX; // Custo de um estado sem solução (célula vazia sem candidatos)
+
+// Função recursiva do IDA*: busca em profundidade limitada pelo custo f(n) = g(n) + h(n)
+// Como toda solução preenche o mesmo número de células, o custo de um passo é a posição do número entre os
+// candidatos válidos da célula (0 para o primeiro, 1 para o segundo, ...): g(n) soma esses desvios da primeira
+// escolha ao longo do caminho e h(n) é 0, ou infinito quando alguma célula vazia não tem candidatos.
+// Retorna -1 se resolveu ou o menor custo acima do limite (CUSTO_INFINITO se não houver)
+int buscaIDAEstrela(vector<vector<int>>& tabuleiro, int g, int limite) {
+    int candidatos;
+    pair<int, int> melhorCelula = encontrarCelulaComMenosCandidatos(tabuleiro, &candidatos);    // Encontrar a célula com menos candidatos válidos
+
+    if (melhorCelula.first == -1 && melhorCelula.second == -1) {    // Sudoku resolvido
+        return -1;
+    }
+    if (candidatos == 0) {
+        return CUSTO_INFINITO;  // h(n) infinito: nenhum número pode ser colocado na célula
+    }
+
+    int linha = melhorCelula.first;     // Linha da célula com menos candidatos
+    int coluna = melhorCelula.second;   // Coluna da célula com menos candidatos
+
+    int proximoLimite = CUSTO_INFINITO;
+    int posicao = 0;                    // Posição do número entre os candidatos válidos da célula
+    for (int num = 1; num <= 9; num++) {
+        if (eSeguro(tabuleiro, linha, coluna, num)) {   // Verifica se o número é seguro para ser colocado na célula vazia
+            int custo = g + posicao++;                  // f(n) do filho
+            if (custo > limite) {
+                proximoLimite = min(proximoLimite, custo);
+                break;          // Os próximos candidatos custam ainda mais: ficam para um limite maior
+            }
+            tabuleiro[linha][coluna] = num;             // Atribui o número à célula vazia
+            int resultado = buscaIDAEstrela(tabuleiro, custo, limite);
+            if (resultado == -1) {
+                return -1;      // Sudoku resolvido
+            }
+            proximoLimite = min(proximoLimite, resultado);
+            tabuleiro[linha][coluna] = 0;               // Desfaz a atribuição antes de tentar o próximo número
+        }
+    }
+
+    return proximoLimite;
+}
+
+// Função de busca IDA* (A* com aprofundamento iterativo) para resolver o Sudoku
+// Usa memória linear no número de células vazias. Cada passada explora os caminhos com f(n) até o limite;
+// se não encontrar a solução, o limite passa a ser o menor f(n) que o ultrapassou
+bool resolverSudokuIDAEstrela(vector<vector<int>>& tabuleiro) {
+    int limite = 0; // Primeira passada: só a primeira escolha de cada célula
+    while (limite != CUSTO_INFINITO) {
+        int resultado = buscaIDAEstrela(tabuleiro, 0, limite);
+        if (resultado == -1) {
+            return true;
+        }
+        limite = resultado; // Menor custo que ultrapassou o limite anterior
+    }
+
+    return false;
+}
+
+#ifndef SUDOKU_SEM_MAIN // Definido por sudoku_benchmark.cpp, que reaproveita as funcoes deste arquivo
+
 //  MAIN
 //
 // Parametros:
 // -i: Imprimir tabuleiros e resultados
 // -t: Imprimir tempo de execucao
+// -c: Usar cache de tabuleiros equivalentes
+// -p: Salvar o cache em disco (cache_<algoritmo>.txt), implica -c
 int main(int argc, char *argv[]) {
     int numeroDeTestes = 100;
     vector<float> temposDFS;
     vector<float> temposBFS;
+    vector<float> temposBFSParalelo;
     vector<float> temposGuloso;
     vector<float> temposAEstrela;
+    vector<float> temposIDAEstrela;
     vector<float> memoriaDFS(numeroDeTestes);
     vector<float> memoriaBFS(numeroDeTestes);
+    vector<float> memoriaBFSParalelo(numeroDeTestes);
     vector<float> memoriaGuloso(numeroDeTestes);
     vector<float> memoriaAEstrela(numeroDeTestes);
+    vector<float> memoriaIDAEstrela(numeroDeTestes);
+    CacheSudoku cacheDFS;
+    CacheSudoku cacheBFS;
+    CacheSudoku cacheBFSParalelo;
+    CacheSudoku cacheGuloso;
+    CacheSudoku cacheAEstrela;
+    CacheSudoku cacheIDAEstrela;
     
     // Processa argumentos da linha de comando
     bool imprimir = false;
     bool imprimirTempo = false;
+    bool usarCache = false;
+    bool persistirCache = false;
     int opt;
-    while ((opt = getopt(argc, argv, "it")) != -1) {
+    while ((opt = getopt(argc, argv, "itcp")) != -1) {
         switch (opt) {
             case 'i':
                 imprimir = true;
@@ -471,12 +1244,29 @@ int main(int argc, char *argv[]) {
             case 't':
                 imprimirTempo = true;
                 break;
+            case 'c':
+                usarCache = true;
+                break;
+            case 'p':
+                usarCache = true;
+                persistirCache = true;
+                break;
             default:
-                cerr << "Uso: " << argv[0] << " [-i] [-t]" << endl;
+                cerr << "Uso: " << argv[0] << " [-i] [-t] [-c] [-p]" << endl;
                 return 1;
         }
     }
 
+    // Carrega os caches salvos em execucoes anteriores
+    if (persistirCache) {
+        carregarCache(cacheDFS, "cache_DFS.txt");
+        carregarCache(cacheBFS, "cache_BFS.txt");
+        carregarCache(cacheBFSParalelo, "cache_BFSParalelo.txt");
+        carregarCache(cacheGuloso, "cache_Guloso.txt");
+        carregarCache(cacheAEstrela, "cache_AEstrela.txt");
+        carregarCache(cacheIDAEstrela, "cache_IDAEstrela.txt");
+    }
+
     // Executa os testes de Sudoku na pasta testes
     for (int teste = 1; teste <= numeroDeTestes; teste++) {
         string name = "testes/" + to_string(teste) + ".txt";
@@ -494,52 +1284,83 @@ int main(int argc, char *argv[]) {
 
         vector<vector<int>> tabuleiroDFS = tabuleiro;
         vector<vector<int>> tabuleiroBFS = tabuleiro;
+        vector<vector<int>> tabuleiroBFSParalelo = tabuleiro;
         vector<vector<int>> tabuleiroGuloso = tabuleiro;
         vector<vector<int>> tabuleiroAEstrela = tabuleiro;
+        vector<vector<int>> tabuleiroIDAEstrela = tabuleiro;
 
-        int tempoResolucaoDFS = resolve(tabuleiroDFS, resolverSudokuDFS, imprimirTempo, DFS);
+        int tempoResolucaoDFS = resolve(tabuleiroDFS, resolverSudokuDFS, imprimirTempo, DFS, usarCache ? &cacheDFS : nullptr);
         if (tempoResolucaoDFS != -1) {
             temposDFS.push_back(tempoResolucaoDFS);
         }
         memoriaDFS[teste - 1] = usoDeMemoria();
 
-        int tempoResolucaoBFS = resolve(tabuleiroBFS, resolverSudokuBFS, imprimirTempo, BFS);
+        int tempoResolucaoBFS = resolve(tabuleiroBFS, resolverSudokuBFS, imprimirTempo, BFS, usarCache ? &cacheBFS : nullptr);
         if (tempoResolucaoBFS != -1) {
             temposBFS.push_back(tempoResolucaoBFS);
         }
         memoriaBFS[teste - 1] = usoDeMemoria();
 
-        int tempoResolucaoGuloso = resolve(tabuleiroGuloso, resolverSudokuGuloso, imprimirTempo, Guloso);
+        int tempoResolucaoBFSParalelo = resolve(tabuleiroBFSParalelo, resolverSudokuBFSParalelo, imprimirTempo, BFSParalelo, usarCache ? &cacheBFSParalelo : nullptr);
+        if (tempoResolucaoBFSParalelo != -1) {
+            temposBFSParalelo.push_back(tempoResolucaoBFSParalelo);
+        }
+        memoriaBFSParalelo[teste - 1] = usoDeMemoria();
+
+        int tempoResolucaoGuloso = resolve(tabuleiroGuloso, resolverSudokuGuloso, imprimirTempo, Guloso, usarCache ? &cacheGuloso : nullptr);
         if (tempoResolucaoGuloso != -1) {
             temposGuloso.push_back(tempoResolucaoGuloso);
         }
         memoriaGuloso[teste - 1] = usoDeMemoria();
 
-        int tempoResolucaoAEstrela = resolve(tabuleiroAEstrela, resolverSudokuAEstrela, imprimirTempo, AEstrela);
+        int tempoResolucaoAEstrela = resolve(tabuleiroAEstrela, resolverSudokuAEstrela, imprimirTempo, AEstrela, usarCache ? &cacheAEstrela : nullptr);
         if (tempoResolucaoAEstrela != -1) {
             temposAEstrela.push_back(tempoResolucaoAEstrela);
         }
         memoriaAEstrela[teste - 1] = usoDeMemoria();
+
+        int tempoResolucaoIDAEstrela = resolve(tabuleiroIDAEstrela, resolverSudokuIDAEstrela, imprimirTempo, IDAEstrela, usarCache ? &cacheIDAEstrela : nullptr);
+        if (tempoResolucaoIDAEstrela != -1) {
+            temposIDAEstrela.push_back(tempoResolucaoIDAEstrela);
+        }
+        memoriaIDAEstrela[teste - 1] = usoDeMemoria();
+    }
+
+    // Salva os caches para as proximas execucoes
+    if (persistirCache) {
+        if (!salvarCache(cacheDFS, "cache_DFS.txt") || !salvarCache(cacheBFS, "cache_BFS.txt") || !salvarCache(cacheBFSParalelo, "cache_BFSParalelo.txt") ||
+            !salvarCache(cacheGuloso, "cache_Guloso.txt") || !salvarCache(cacheAEstrela, "cache_AEstrela.txt") ||
+            !salvarCache(cacheIDAEstrela, "cache_IDAEstrela.txt")) {
+            cerr << "Erro ao salvar os arquivos de cache" << endl;
+        }
     }
 
     // Calculo dos resultados de tempo
     float mediaTempoDFS = media(temposDFS);
     float mediaTempoBFS = media(temposBFS);
+    float mediaTempoBFSParalelo = media(temposBFSParalelo);
     float mediaTempoGuloso = media(temposGuloso);
     float mediaTempoAEstrela = media(temposAEstrela);
+    float mediaTempoIDAEstrela = media(temposIDAEstrela);
     float desvioTempoDFS = desvioPadrao(temposDFS, mediaTempoDFS);
     float desvioTempoBFS = desvioPadrao(temposBFS, mediaTempoBFS);
+    float desvioTempoBFSParalelo = desvioPadrao(temposBFSParalelo, mediaTempoBFSParalelo);
     float desvioTempoGuloso = desvioPadrao(temposGuloso, mediaTempoGuloso);
     float desvioTempoAEstrela = desvioPadrao(temposAEstrela, mediaTempoAEstrela);
+    float desvioTempoIDAEstrela = desvioPadrao(temposIDAEstrela, mediaTempoIDAEstrela);
     // Calculo dos resultados de memoria
     float mediaMemoriaDFS = media(memoriaDFS);
     float mediaMemoriaBFS = media(memoriaBFS);
+    float mediaMemoriaBFSParalelo = media(memoriaBFSParalelo);
     float mediaMemoriaGuloso = media(memoriaGuloso);
     float mediaMemoriaAEstrela = media(memoriaAEstrela);
+    float mediaMemoriaIDAEstrela = media(memoriaIDAEstrela);
     float desvioMemoriaDFS = desvioPadrao(memoriaDFS, mediaMemoriaDFS);
     float desvioMemoriaBFS = desvioPadrao(memoriaBFS, mediaMemoriaBFS);
+    float desvioMemoriaBFSParalelo = desvioPadrao(memoriaBFSParalelo, mediaMemoriaBFSParalelo);
     float desvioMemoriaGuloso = desvioPadrao(memoriaGuloso, mediaMemoriaGuloso);
     float desvioMemoriaAEstrela = desvioPadrao(memoriaAEstrela, mediaMemoriaAEstrela);
+    float desvioMemoriaIDAEstrela = desvioPadrao(memoriaIDAEstrela, mediaMemoriaIDAEstrela);
 
     // Imprime resultados
     cout << endl;
@@ -554,6 +1375,11 @@ int main(int argc, char *argv[]) {
     cout << " Media memoria BFS: " << mediaMemoriaBFS << " KB" << endl;
     cout << " Desvio padrao memoria BFS: " << desvioMemoriaBFS << " KB" << endl;
     cout << endl;
+    cout << " Media tempo BFSParalelo: " << mediaTempoBFSParalelo << " microssegundos" << endl;
+    cout << " Desvio padrao tempo BFSParalelo: " << desvioTempoBFSParalelo << " microssegundos" << endl;
+    cout << " Media memoria BFSParalelo: " << mediaMemoriaBFSParalelo << " KB" << endl;
+    cout << " Desvio padrao memoria BFSParalelo: " << desvioMemoriaBFSParalelo << " KB" << endl;
+    cout << endl;
     cout << " Media tempo Guloso: " << mediaTempoGuloso << " microssegundos" << endl;
     cout << " Desvio padrao tempo Guloso: " << desvioTempoGuloso << " microssegundos" << endl;
     cout << " Media memoria Guloso: " << mediaMemoriaGuloso << " KB" << endl;
@@ -563,6 +1389,11 @@ int main(int argc, char *argv[]) {
     cout << " Desvio padrao tempo AEstrela: " << desvioTempoAEstrela << " microssegundos" << endl;
     cout << " Media memoria AEstrela: " << mediaMemoriaAEstrela << " KB" << endl;
     cout << " Desvio padrao memoria AEstrela: " << desvioMemoriaAEstrela << " KB" << endl;
+    cout << endl;
+    cout << " Media tempo IDAEstrela: " << mediaTempoIDAEstrela << " microssegundos" << endl;
+    cout << " Desvio padrao tempo IDAEstrela: " << desvioTempoIDAEstrela << " microssegundos" << endl;
+    cout << " Media memoria IDAEstrela: " << mediaMemoriaIDAEstrela << " KB" << endl;
+    cout << " Desvio padrao memoria IDAEstrela: " << desvioMemoriaIDAEstrela << " KB" << endl;
     cout << "==================================================" << endl;
     cout << endl;
 
@@ -570,7 +1401,7 @@ int main(int argc, char *argv[]) {
     ofstream arquivoCSV("resultados.csv");
     if(arquivoCSV.is_open()) {
         // Cabeçalho do arquivo CSV
-        arquivoCSV << "Dados,DFS Tempo(microssegundos),BFS Tempo(microssegundos),Guloso Tempo(microssegundos),AEstrela Tempo(microssegundos),DFS Memoria(KB),BFS Memoria(KB),Guloso Memoria(KB), AEstrela Memoria(KB)\n";
+        arquivoCSV << "Dados,DFS Tempo(microssegundos),BFS Tempo(microssegundos),BFSParalelo Tempo(microssegundos),Guloso Tempo(microssegundos),AEstrela Tempo(microssegundos),IDAEstrela Tempo(microssegundos),DFS Memoria(KB),BFS Memoria(KB),BFSParalelo Memoria(KB),Guloso Memoria(KB), AEstrela Memoria(KB),IDAEstrela Memoria(KB)\n";
         
         // Escrever tempos de execução e uso de memória
         size_t maxSize = max(temposDFS.size(), temposBFS.size());
@@ -584,6 +1415,10 @@ int main(int argc, char *argv[]) {
                 arquivoCSV << temposBFS[i];
             }
             arquivoCSV << ",";
+            if (i < temposBFSParalelo.size()) {
+                arquivoCSV << temposBFSParalelo[i];
+            }
+            arquivoCSV << ",";
             if (i < temposGuloso.size()) {
                 arquivoCSV << temposGuloso[i];
             }
@@ -592,6 +1427,10 @@ int main(int argc, char *argv[]) {
                 arquivoCSV << temposAEstrela[i];
             }
             arquivoCSV << ",";
+            if (i < temposIDAEstrela.size()) {
+                arquivoCSV << temposIDAEstrela[i];
+            }
+            arquivoCSV << ",";
             if (i < memoriaDFS.size()) {
                 arquivoCSV << memoriaDFS[i];
             }
@@ -600,6 +1439,10 @@ int main(int argc, char *argv[]) {
                 arquivoCSV << memoriaBFS[i];
             }
             arquivoCSV << ",";
+            if (i < memoriaBFSParalelo.size()) {
+                arquivoCSV << memoriaBFSParalelo[i];
+            }
+            arquivoCSV << ",";
             if (i < memoriaGuloso.size()) {
                 arquivoCSV << memoriaGuloso[i];
             }
@@ -607,14 +1450,18 @@ int main(int argc, char *argv[]) {
             if (i < memoriaAEstrela.size()) {
                 arquivoCSV << memoriaAEstrela[i];
             }
+            arquivoCSV << ",";
+            if (i < memoriaIDAEstrela.size()) {
+                arquivoCSV << memoriaIDAEstrela[i];
+            }
             arquivoCSV << "\n";
         }
         
         // Escrever média e desvio padrão
-        arquivoCSV << "Tempo Medio," << mediaTempoDFS << "," << mediaTempoBFS << "," << mediaTempoGuloso << "," << mediaTempoAEstrela << "\n";
-        arquivoCSV << "Tempo Desvio Padrao," << desvioTempoDFS << "," << desvioTempoBFS << "," << desvioTempoGuloso << "," << desvioTempoAEstrela << "\n";
-        arquivoCSV << "Memoria Media," << ",,,," << mediaMemoriaDFS << "," << mediaMemoriaBFS << "," << mediaMemoriaGuloso << "," << mediaMemoriaAEstrela << "\n";
-        arquivoCSV << "Memoria Desvio Padrao," << ",,,," << desvioMemoriaDFS << "," << desvioMemoriaBFS << "," << desvioMemoriaGuloso << "," << desvioMemoriaAEstrela << "\n";
+        arquivoCSV << "Tempo Medio," << mediaTempoDFS << "," << mediaTempoBFS << "," << mediaTempoBFSParalelo << "," << mediaTempoGuloso << "," << mediaTempoAEstrela << "," << mediaTempoIDAEstrela << "\n";
+        arquivoCSV << "Tempo Desvio Padrao," << desvioTempoDFS << "," << desvioTempoBFS << "," << desvioTempoBFSParalelo << "," << desvioTempoGuloso << "," << desvioTempoAEstrela << "," << desvioTempoIDAEstrela << "\n";
+        arquivoCSV << "Memoria Media," << ",,,,,," << mediaMemoriaDFS << "," << mediaMemoriaBFS << "," << mediaMemoriaBFSParalelo << "," << mediaMemoriaGuloso << "," << mediaMemoriaAEstrela << "," << mediaMemoriaIDAEstrela << "\n";
+        arquivoCSV << "Memoria Desvio Padrao," << ",,,,,," << desvioMemoriaDFS << "," << desvioMemoriaBFS << "," << desvioMemoriaBFSParalelo << "," << desvioMemoriaGuloso << "," << desvioMemoriaAEstrela << "," << desvioMemoriaIDAEstrela << "\n";
 
         // Fechar o arquivo
         arquivoCSV.close();
@@ -627,7 +1474,10 @@ int main(int argc, char *argv[]) {
     cout << endl << "[POSSIVEIS OPCOES DE EXECUCAO]" << endl;
     cout <<  "-i" << '\t' << "Imprimir tabuleiros" << endl;
     cout <<  "-t" << '\t' << "Imprimir tempo de execucao" << endl;
+    cout <<  "-c" << '\t' << "Usar cache de tabuleiros equivalentes" << endl;
+    cout <<  "-p" << '\t' << "Salvar o cache em disco entre execucoes" << endl;
     cout << endl;
 
     return 0;
 }
+#endif
@@ -0,0 +1,123 @@
+#define SUDOKU_SEM_MAIN
+#include "sudoku.cpp" // Funcoes dos algoritmos, sem a main dos testes completos
+#include <x86intrin.h>
+
+// Tabuleiros fixos usados nas medicoes (linha a linha, 0 = vazio)
+const string TABULEIRO_FACIL   = "530070000600195000098000060800060003400803001700020006060000280000419005000080079";
+const string TABULEIRO_DIFICIL = "800000000003600000070090200050007000000045700000100030001000068008500010090000400";
+const string TABULEIRO_RESOLVIDO = "534678912672195348198342567859761423426853791713924856961537284287419635345286179";
+
+const int REPETICOES = 5; // A melhor das repeticoes e a reportada
+
+// Funcao para converter um tabuleiro em texto para a matriz usada pelos algoritmos
+vector<vector<int>> tabuleiroDeTexto(const string& texto) {
+    vector<vector<int>> tabuleiro(N, vector<int>(N, 0));
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            tabuleiro[i][j] = texto[i * N + j] - '0';
+        }
+    }
+    return tabuleiro;
+}
+
+// Funcao que impede o compilador de descartar um resultado ou de supor que um valor nao mudou
+template <typename T>
+void naoOtimizar(T& valor) {
+    asm volatile("" : "+m"(valor) : : "memory");
+}
+
+// Funcao que le o contador de ciclos (TSC) sem que instrucoes vizinhas sejam reordenadas em volta da leitura
+// O TSC conta ciclos de referencia (frequencia nominal), nao ciclos reais do nucleo
+unsigned long long lerCiclosInicio() {
+    _mm_lfence();
+    unsigned long long ciclos = __rdtsc();
+    _mm_lfence();
+    return ciclos;
+}
+
+unsigned long long lerCiclosFim() {
+    unsigned int processador;
+    unsigned long long ciclos = __rdtscp(&processador); // Espera as instrucoes anteriores terminarem
+    _mm_lfence();
+    return ciclos;
+}
+
+// Funcao que mede um kernel e imprime ns/chamada, ciclos de referencia/chamada e chamadas/s
+// O kernel recebe o indice da chamada para variar as entradas entre chamadas
+template <typename Kernel>
+void medir(const string& nome, long long chamadas, Kernel kernel) {
+    double melhorNs = -1, melhorCiclos = -1;
+
+    for (int repeticao = 0; repeticao < REPETICOES; repeticao++) {
+        chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+        unsigned long long cicloInicial = lerCiclosInicio();
+
+        for (long long chamada = 0; chamada < chamadas; chamada++) {
+            kernel(chamada);
+        }
+
+        unsigned long long cicloFinal = lerCiclosFim();
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        double ns = chrono::duration_cast<chrono::nanoseconds>(end - begin).count() / static_cast<double>(chamadas);
+        double ciclos = (cicloFinal - cicloInicial) / static_cast<double>(chamadas);
+        if (melhorNs < 0 || ns < melhorNs) {
+            melhorNs = ns;
+            melhorCiclos = ciclos;
+        }
+    }
+
+    cout << nome << '\t' << melhorNs << " ns/chamada" << '\t' << melhorCiclos << " ciclos ref./chamada" << '\t' << 1e9 / melhorNs << " chamadas/s" << endl;
+}
+
+int main() {
+    vector<vector<int>> facil = tabuleiroDeTexto(TABULEIRO_FACIL);
+    vector<vector<int>> dificil = tabuleiroDeTexto(TABULEIRO_DIFICIL);
+    vector<vector<int>> resolvido = tabuleiroDeTexto(TABULEIRO_RESOLVIDO);
+    long long resultado = 0; // Acumula os retornos dos kernels para que nao sejam eliminados
+
+    cout << "==================================================" << endl;
+    cout << " Microbenchmarks (melhor de " << REPETICOES << " repeticoes)" << endl;
+#ifdef __OPTIMIZE__
+    cout << " Compilado com otimizacao (o makefile usa -O2 tambem em sud)" << endl;
+#else
+    cout << " Compilado SEM otimizacao: os tempos nao correspondem ao sud do makefile (-O2)" << endl;
+#endif
+    cout << "==================================================" << endl;
+
+    // eSeguro percorre todas as celulas e numeros do tabuleiro facil
+    medir("eSeguro", 2000000, [&](long long chamada) {
+        int celula = chamada % (N * N);
+        naoOtimizar(facil);
+        resultado += eSeguro(facil, celula / N, celula % N, chamada % 9 + 1);
+    });
+
+    // contarCandidatosValidos percorre todas as celulas do tabuleiro dificil
+    medir("contarCandidatosValidos", 1000000, [&](long long chamada) {
+        int celula = chamada % (N * N);
+        naoOtimizar(dificil);
+        resultado += contarCandidatosValidos(dificil, celula / N, celula % N);
+    });
+
+    medir("encontrarCelulaComMenosCandidatos", 20000, [&](long long chamada) {
+        naoOtimizar(dificil);
+        pair<int, int> celula = encontrarCelulaComMenosCandidatos(dificil);
+        resultado += celula.first + celula.second + chamada;
+    });
+
+    medir("funcaoCusto", 200000, [&](long long chamada) {
+        naoOtimizar(facil);
+        resultado += funcaoCusto(facil, chamada & 63);
+    });
+
+    medir("verificarSolucao", 5000, [&](long long) {
+        naoOtimizar(resolvido);
+        resultado += verificarSolucao(resolvido);
+    });
+
+    naoOtimizar(resultado);
+    cout << "==================================================" << endl;
+    cout << "Checksum: " << resultado << endl;
+
+    return 0;
+}